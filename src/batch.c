@@ -0,0 +1,225 @@
+/**
+ * @file batch.c
+ * @brief Implementation of the full-dictionary solver sweep
+ *
+ * Workers pull target indices from a shared atomic counter and
+ * keep private statistics, which are merged after all threads
+ * have been joined.
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "wordle.h"
+#include "solver.h"
+#include "guess_cache.h"
+#include "batch.h"
+
+/**
+ * @brief Work shared by all workers (read-only except next_target)
+ */
+typedef struct {
+    char** words;               /**< Master word list (not owned) */
+    int word_count;             /**< Number of words / games */
+    SolverState* initial;       /**< Start state (and strategy) cloned by every game */
+    GuessCache* cache;          /**< Shared cache, or NULL (one strategy per cache) */
+    atomic_int next_target;     /**< Next target index to play */
+} BatchJob;
+
+/**
+ * @brief Per-worker context and statistics
+ */
+typedef struct {
+    BatchJob* job;                      /**< Shared work description */
+    int solved_in[MAX_ATTEMPTS + 1];    /**< [k] = games won in k guesses, [0] = lost */
+    int errors;                         /**< Games aborted (allocation failure) */
+} BatchWorker;
+
+/**
+ * @brief Plays one solver game against 'target'
+ *
+ * @return Number of guesses used, 0 if the game was lost, -1 on error
+ */
+static int play_game(BatchJob* job, const char* target) {
+    /* Cloning skips rebuilding the frequency tables from all n words */
+    SolverState* state = clone_solver(job->initial);
+    if (!state) {
+        return -1;
+    }
+
+    char history[HISTORY_KEY_LENGTH] = "";
+    char result[WORD_LENGTH + 1];
+    int solved = 0;
+
+    for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
+        char* guess = get_best_guess_cached(state, job->cache, history);
+        if (!guess) {
+            break;
+        }
+
+        get_feedback(target, guess, result);
+        if (strcmp(guess, target) == 0) {
+            solved = attempt;
+            break;
+        }
+
+        /* No further guess follows the last attempt */
+        if (attempt < MAX_ATTEMPTS) {
+            append_history(history, guess, result);
+            if (!load_cached_candidates(job->cache, history, state)) {
+                filter_candidates(state, guess, result);
+            }
+        }
+    }
+
+    free_solver(state);
+    return solved;
+}
+
+/**
+ * @brief Worker thread: plays games until no targets remain
+ */
+static void* batch_worker(void* arg) {
+    BatchWorker* worker = (BatchWorker*)arg;
+    BatchJob* job = worker->job;
+
+    for (;;) {
+        int target_idx = atomic_fetch_add(&job->next_target, 1);
+        if (target_idx >= job->word_count) {
+            break;
+        }
+
+        int solved = play_game(job, job->words[target_idx]);
+        if (solved < 0) {
+            worker->errors++;
+        } else {
+            worker->solved_in[solved]++;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Returns wall-clock time in seconds
+ */
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Spawns workers, merges their statistics and prints a report
+ */
+int run_batch(char** words, int word_count, int thread_count, int use_cache,
+              SolverStrategy strategy) {
+    if (thread_count < 1) {
+        thread_count = 1;
+    }
+    if (thread_count > BATCH_MAX_THREADS) {
+        thread_count = BATCH_MAX_THREADS;
+    }
+
+    BatchJob job;
+    job.words = words;
+    job.word_count = word_count;
+    job.cache = NULL;
+    atomic_init(&job.next_target, 0);
+
+    job.initial = init_solver(words, word_count);
+    if (!job.initial) {
+        printf("ERROR: Failed to initialize solver.\n");
+        return 1;
+    }
+    job.initial->strategy = strategy;
+
+    if (use_cache) {
+        job.cache = init_guess_cache(BATCH_CACHE_CAPACITY);
+        if (!job.cache) {
+            printf("ERROR: Failed to allocate guess cache.\n");
+            free_solver(job.initial);
+            return 1;
+        }
+    }
+
+    pthread_t threads[BATCH_MAX_THREADS];
+    BatchWorker workers[BATCH_MAX_THREADS];
+    int started = 0;
+
+    double start_time = now_seconds();
+
+    for (int t = 0; t < thread_count; t++) {
+        memset(&workers[t], 0, sizeof(BatchWorker));
+        workers[t].job = &job;
+        if (pthread_create(&threads[t], NULL, batch_worker, &workers[t]) != 0) {
+            break;
+        }
+        started++;
+    }
+
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    double elapsed = now_seconds() - start_time;
+
+    if (started == 0) {
+        printf("ERROR: Failed to start worker threads.\n");
+        free_solver(job.initial);
+        free_guess_cache(job.cache);
+        return 1;
+    }
+
+    /* Merge per-worker statistics */
+    int solved_in[MAX_ATTEMPTS + 1] = {0};
+    int errors = 0;
+    for (int t = 0; t < started; t++) {
+        for (int k = 0; k <= MAX_ATTEMPTS; k++) {
+            solved_in[k] += workers[t].solved_in[k];
+        }
+        errors += workers[t].errors;
+    }
+
+    int wins = 0;
+    long total_guesses = 0;
+    for (int k = 1; k <= MAX_ATTEMPTS; k++) {
+        wins += solved_in[k];
+        total_guesses += (long)k * solved_in[k];
+    }
+
+    printf("=== BATCH RESULTS (%d games, %d threads, %s strategy) ===\n",
+           word_count, started,
+           strategy == STRATEGY_POSITIONAL_FREQUENCY ? "positional" : "letter");
+    for (int k = 1; k <= MAX_ATTEMPTS; k++) {
+        printf("  Solved in %d: %d\n", k, solved_in[k]);
+    }
+    printf("  Failed:      %d\n", solved_in[0]);
+    if (errors > 0) {
+        printf("  Errors:      %d\n", errors);
+    }
+    if (wins > 0) {
+        printf("  Average guesses (wins): %.3f\n", (double)total_guesses / wins);
+    }
+
+    if (job.cache) {
+        long lookups = job.cache->hits + job.cache->misses;
+        printf("  Cache: %ld hits, %ld misses (%.1f%% hit rate), %d entries\n",
+               job.cache->hits, job.cache->misses,
+               lookups > 0 ? 100.0 * job.cache->hits / lookups : 0.0,
+               job.cache->size);
+        printf("  Filter passes skipped: %ld\n", job.cache->filters_skipped);
+    } else {
+        printf("  Cache: disabled\n");
+    }
+    printf("  Time: %.3f s\n", elapsed);
+
+    free_solver(job.initial);
+    free_guess_cache(job.cache);
+    return errors > 0 ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file batch.h
+ * @brief Header file for the full-dictionary solver sweep
+ *
+ * Plays one solver game for every word in the dictionary, spread
+ * over worker threads that share a single best-guess cache.
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "solver.h"
+
+/*============================================================
+ * CONSTANTS
+ *============================================================*/
+
+/** Worker threads used when none are requested */
+#define BATCH_DEFAULT_THREADS 4
+
+/** Upper bound on worker threads */
+#define BATCH_MAX_THREADS 64
+
+/** Slots in the shared best-guess cache */
+#define BATCH_CACHE_CAPACITY 65536
+
+/*============================================================
+ * FUNCTION PROTOTYPES
+ *============================================================*/
+
+/**
+ * @brief Runs the solver against every word and prints statistics
+ *
+ * Reports the guess distribution, failures, average guesses,
+ * cache hits/misses and wall-clock time.
+ *
+ * Time Complexity: O(n * MAX_ATTEMPTS * n * WORD_LENGTH^2) without
+ * cache hits; shared states are scored and filtered only once.
+ *
+ * @param words Master word list
+ * @param word_count Number of words in the list
+ * @param thread_count Number of worker threads (clamped to 1..BATCH_MAX_THREADS)
+ * @param use_cache 0 to disable the shared cache (for comparison)
+ * @param strategy Scoring strategy used by every game
+ * @return 0 on success, 1 on allocation or thread failure
+ */
+int run_batch(char** words, int word_count, int thread_count, int use_cache,
+              SolverStrategy strategy);
+
+#endif /* BATCH_H */
@@ -0,0 +1,166 @@
+/**
+ * @file guess_cache.c
+ * @brief Implementation of the shared best-guess cache
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "guess_cache.h"
+
+/**
+ * @brief FNV-1a hash of a history key
+ */
+static unsigned int hash_key(const char* key) {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; key[i]; i++) {
+        hash ^= (unsigned char)key[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Finds the slot holding 'key', or the empty slot where it belongs
+ *
+ * Caller must hold cache->lock. The table is never full (see
+ * get_best_guess_cached), so probing always terminates.
+ */
+static CacheEntry* find_slot(GuessCache* cache, const char* key) {
+    int idx = (int)(hash_key(key) % (unsigned int)cache->capacity);
+
+    while (cache->entries[idx].used && strcmp(cache->entries[idx].key, key) != 0) {
+        idx = (idx + 1) % cache->capacity;
+    }
+    return &cache->entries[idx];
+}
+
+/**
+ * @brief Allocates a cache with all slots empty
+ */
+GuessCache* init_guess_cache(int capacity) {
+    GuessCache* cache = (GuessCache*)malloc(sizeof(GuessCache));
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->entries = (CacheEntry*)calloc(capacity, sizeof(CacheEntry));
+    if (!cache->entries) {
+        free(cache);
+        return NULL;
+    }
+
+    cache->capacity = capacity;
+    cache->size = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->filters_skipped = 0;
+    pthread_mutex_init(&cache->lock, NULL);
+
+    return cache;
+}
+
+/**
+ * @brief Frees the slot array and the cache
+ */
+void free_guess_cache(GuessCache* cache) {
+    if (cache) {
+        pthread_mutex_destroy(&cache->lock);
+        for (int i = 0; i < cache->capacity; i++) {
+            free(cache->entries[i].survivors);
+        }
+        free(cache->entries);
+        free(cache);
+    }
+}
+
+/**
+ * @brief Appends guess and feedback to the key
+ */
+void append_history(char* history, const char* guess, const char* result) {
+    strcat(history, guess);
+    strcat(history, result);
+}
+
+/**
+ * @brief Copies the survivor list of a cached history into the state
+ *
+ * Entries are immutable once inserted and freed only with the cache,
+ * so the list can be read after the lock is released.
+ */
+bool load_cached_candidates(GuessCache* cache, const char* history, SolverState* state) {
+    if (!cache) {
+        return false;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    CacheEntry* slot = find_slot(cache, history);
+    bool found = slot->used && slot->survivors;
+    if (found) {
+        cache->filters_skipped++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    if (found) {
+        set_candidates(state, slot->survivors, slot->survivor_count);
+    }
+    return found;
+}
+
+/**
+ * @brief Looks up the history, computing and storing on a miss
+ *
+ * The lock is released while scoring so other threads are not
+ * serialized behind a miss. Two threads missing on the same key
+ * both compute the same answer; the second insert is a no-op.
+ */
+char* get_best_guess_cached(SolverState* state, GuessCache* cache, const char* history) {
+    if (!cache) {
+        return get_best_guess(state);
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    CacheEntry* slot = find_slot(cache, history);
+    if (slot->used) {
+        char* cached = slot->guess;
+        cache->hits++;
+        pthread_mutex_unlock(&cache->lock);
+        return cached;
+    }
+    cache->misses++;
+    pthread_mutex_unlock(&cache->lock);
+
+    char* best = get_best_guess(state);
+
+    /* Snapshot the candidates so later games can skip filtering */
+    int* survivors = (int*)malloc(state->possible_count * sizeof(int));
+    int survivor_count = 0;
+    if (survivors) {
+        for (int i = 0; i < state->total_words; i++) {
+            if (state->possible_mask[i]) {
+                survivors[survivor_count++] = i;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    /* Keep load factor <= 3/4 so probing stays short and terminates */
+    if (best && (cache->size + 1) * 4 <= cache->capacity * 3) {
+        slot = find_slot(cache, history);
+        if (!slot->used) {
+            strcpy(slot->key, history);
+            slot->guess = best;
+            slot->survivors = survivors;
+            slot->survivor_count = survivor_count;
+            slot->used = true;
+            cache->size++;
+            survivors = NULL;  /* Now owned by the cache */
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    free(survivors);
+
+    return best;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file guess_cache.h
+ * @brief Header file for the shared best-guess cache
+ *
+ * The solver is deterministic: the same sequence of guesses and
+ * feedback always leaves the same candidates and therefore the same
+ * next guess. This cache memoizes get_best_guess() by that feedback
+ * history so many games (and threads) can reuse each other's work.
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#ifndef GUESS_CACHE_H
+#define GUESS_CACHE_H
+
+#include <stdbool.h>
+#include <pthread.h>
+#include "wordle.h"
+#include "solver.h"
+
+/*============================================================
+ * CONSTANTS
+ *============================================================*/
+
+/** Maximum length of a history key: guess + feedback per attempt */
+#define HISTORY_KEY_LENGTH (MAX_ATTEMPTS * 2 * WORD_LENGTH + 1)
+
+/*============================================================
+ * DATA STRUCTURES
+ *============================================================*/
+
+/**
+ * @brief One cached decision
+ *
+ * Besides the guess, stores the candidates left by the history, so
+ * a game reaching the same history can skip filter_candidates().
+ * Entries are never modified after insertion.
+ */
+typedef struct {
+    char key[HISTORY_KEY_LENGTH];   /**< Feedback history, "" = first guess */
+    char* guess;                    /**< Chosen guess (not owned) */
+    int* survivors;                 /**< Candidate indices for this history (owned), or NULL */
+    int survivor_count;             /**< Number of survivors */
+    bool used;                      /**< true if slot holds an entry */
+} CacheEntry;
+
+/**
+ * @brief Bounded, thread-safe hash table of decisions
+ *
+ * Open addressing with linear probing. Once the table is 3/4 full,
+ * new entries are dropped instead of evicting old ones: early game
+ * states are inserted first and are also the most widely shared.
+ *
+ * Space Complexity: O(capacity + n * MAX_ATTEMPTS) - for a
+ * deterministic solver, the histories of one length partition the
+ * dictionary, so each depth stores at most n survivor indices.
+ */
+typedef struct {
+    CacheEntry* entries;    /**< Slot array */
+    int capacity;           /**< Number of slots */
+    int size;               /**< Number of used slots */
+    long hits;              /**< Lookups answered from the cache */
+    long misses;            /**< Lookups that had to compute */
+    long filters_skipped;   /**< Candidate sets restored instead of filtered */
+    pthread_mutex_t lock;   /**< Guards all of the above */
+} GuessCache;
+
+/*============================================================
+ * FUNCTION PROTOTYPES
+ *============================================================*/
+
+/**
+ * @brief Creates an empty cache
+ *
+ * @param capacity Number of slots to allocate
+ * @return Pointer to new GuessCache, or NULL on failure
+ */
+GuessCache* init_guess_cache(int capacity);
+
+/**
+ * @brief Frees cache memory
+ *
+ * @param cache Pointer to GuessCache to free
+ */
+void free_guess_cache(GuessCache* cache);
+
+/**
+ * @brief Appends one attempt to a history key
+ *
+ * @param history Key buffer (min HISTORY_KEY_LENGTH bytes)
+ * @param guess The word that was guessed
+ * @param result The feedback received (G/Y/X string)
+ */
+void append_history(char* history, const char* guess, const char* result);
+
+/**
+ * @brief Restores the candidates for a history from the cache
+ *
+ * Call after appending the latest attempt to 'history'; on a miss,
+ * the caller runs filter_candidates() itself.
+ *
+ * Time Complexity: O(n) (mask reset) + O(survivors * WORD_LENGTH)
+ * on a hit, instead of O(n * WORD_LENGTH^2) for filtering
+ *
+ * @param cache Shared cache, or NULL
+ * @param history Feedback history including the latest attempt
+ * @param state Solver state to overwrite on a hit
+ * @return true if 'state' was restored, false on a miss
+ */
+bool load_cached_candidates(GuessCache* cache, const char* history, SolverState* state);
+
+/**
+ * @brief Memoized wrapper around get_best_guess()
+ *
+ * Looks the history up first and only scores candidates on a miss.
+ * A miss also records the current candidates for
+ * load_cached_candidates(). The returned guess is identical to
+ * get_best_guess(state) as long as 'history' is the history that
+ * produced 'state'.
+ *
+ * Time Complexity: O(HISTORY_KEY_LENGTH) on a hit,
+ * O(n * WORD_LENGTH) on a miss
+ *
+ * @param state Pointer to SolverState
+ * @param cache Shared cache, or NULL to always compute
+ * @param history Feedback history that produced 'state'
+ * @return Best guess word, or NULL if no candidates remain
+ */
+char* get_best_guess_cached(SolverState* state, GuessCache* cache, const char* history);
+
+#endif /* GUESS_CACHE_H */
@@ -2,9 +2,13 @@
  * @file main.c
  * @brief Main entry point for the Wordle Game and Solver
  * 
- * This file contains the main game loop that supports two modes:
+ * This file contains the main game loop that supports three modes:
  * 1. Human player mode: User guesses the word manually
  * 2. Solver mode: Automated AI solves the puzzle
+ * 3. Assistant mode: User guesses, the solver suggests a hint
+ * 
+ * A fourth, non-interactive batch mode runs the solver against
+ * every dictionary word and reports statistics.
  * 
  * Course: ALGO3 - Algorithms & Data Structures in C
  */
@@ -16,6 +20,8 @@
 #include <ctype.h>
 #include "wordle.h"
 #include "solver.h"
+#include "speculate.h"
+#include "batch.h"
 
 /* ANSI Color Codes for colored terminal output */
 #define ANSI_COLOR_GREEN   "\x1b[32m"
@@ -50,6 +56,11 @@ void print_result_colored(const char* guess, const char* result) {
  * Usage:
  *   ./wordle         - Play the game as a human
  *   ./wordle solver  - Watch the AI solve the puzzle
+ *   ./wordle assistant - Play with hints from the solver
+ *   ./wordle batch [threads] [nocache] - Solve every word, print stats
+ * 
+ * Adding --positional to any solver-based mode switches the solver
+ * to positional letter-frequency scoring.
  */
 int main(int argc, char* argv[]) {
     /* Seed random number generator */
@@ -73,29 +84,69 @@ int main(int argc, char* argv[]) {
     }
     printf("Loaded %d words.\n\n", word_count);
 
+    /* Solver scoring strategy (any position after the mode) */
+    SolverStrategy strategy = STRATEGY_LETTER_FREQUENCY;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--positional") == 0) {
+            strategy = STRATEGY_POSITIONAL_FREQUENCY;
+        }
+    }
+
+    /* Batch mode: full-dictionary sweep, no interactive game */
+    if (argc > 1 && strcmp(argv[1], "batch") == 0) {
+        int threads = BATCH_DEFAULT_THREADS;
+        int use_cache = 1;
+        for (int i = 2; i < argc; i++) {
+            if (strcmp(argv[i], "nocache") == 0) {
+                use_cache = 0;
+            } else if (isdigit((unsigned char)argv[i][0])) {
+                threads = atoi(argv[i]);
+            }
+        }
+        int status = run_batch(words, word_count, threads, use_cache, strategy);
+        free_word_list(words, word_count);
+        return status;
+    }
+
     /* Determine game mode from command line arguments */
     int solver_mode = 0;
+    int assistant_mode = 0;
     if (argc > 1 && strcmp(argv[1], "solver") == 0) {
         solver_mode = 1;
+    } else if (argc > 1 && strcmp(argv[1], "assistant") == 0) {
+        assistant_mode = 1;
     }
 
     /* Select target word randomly */
     int target_idx = rand() % word_count;
     char* target = words[target_idx];
 
-    /* Initialize solver if in solver mode */
+    /* Initialize solver if in solver or assistant mode */
     SolverState* solver = NULL;
-    if (solver_mode) {
+    Speculator* speculator = NULL;
+    if (solver_mode || assistant_mode) {
         solver = init_solver(words, word_count);
-        if (!solver) {
+        if (assistant_mode && solver) {
+            speculator = init_speculator();
+        }
+        if (!solver || (assistant_mode && !speculator)) {
             printf("ERROR: Failed to initialize solver.\n");
+            free_solver(solver);
             free_word_list(words, word_count);
             printf("Press Enter to exit...\n");
             getchar();
             return 1;
         }
+        solver->strategy = strategy;
+    }
+
+    if (solver_mode) {
         printf("=== AUTOMATED SOLVER MODE ===\n");
         printf("Watch the AI solve the puzzle!\n\n");
+    } else if (assistant_mode) {
+        printf("=== ASSISTANT MODE ===\n");
+        printf("Guess the 5-letter word in %d tries.\n", MAX_ATTEMPTS);
+        printf("The solver will suggest a hint before each guess.\n\n");
     } else {
         printf("=== HUMAN PLAYER MODE ===\n");
         printf("Guess the 5-letter word in %d tries.\n\n", MAX_ATTEMPTS);
@@ -105,8 +156,19 @@ int main(int argc, char* argv[]) {
     char guess[100];
     char result[WORD_LENGTH + 1];
     int won = 0;
+    char* hint = assistant_mode ? get_best_guess(solver) : NULL;
 
     for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
+        if (hint) {
+            printf("Hint: %s\n", hint);
+            /*
+             * Precompute the next hint for the likely outcomes of this
+             * one while we block on input (kept across invalid input)
+             */
+            if (!speculator->running) {
+                start_speculation(speculator, solver, hint);
+            }
+        }
         printf("Attempt %d/%d: ", attempt, MAX_ATTEMPTS);
         
         if (solver_mode) {
@@ -148,11 +210,6 @@ int main(int argc, char* argv[]) {
         get_feedback(target, guess, result);
         print_result_colored(guess, result);
 
-        /* Update solver's candidate list */
-        if (solver_mode) {
-            filter_candidates(solver, guess, result);
-        }
-
         /* Check for win condition */
         int all_correct = 1;
         for (int i = 0; i < WORD_LENGTH; i++) {
@@ -161,6 +218,27 @@ int main(int argc, char* argv[]) {
                 break;
             }
         }
+        int game_over = all_correct || attempt == MAX_ATTEMPTS;
+
+        /*
+         * Assistant mode: serve the outcome from the speculative cache,
+         * which restores the filtered candidates and gives the next hint.
+         * Not needed once the game is over (free_speculator stops the
+         * worker).
+         */
+        int restored = 0;
+        if (assistant_mode && !game_over) {
+            hint = take_speculation(speculator, guess, result, solver);
+            restored = (hint != NULL);
+        }
+
+        /* Update solver's candidate list (unless restored above) */
+        if (solver) {
+            if (!restored) {
+                filter_candidates(solver, guess, result);
+            }
+            printf("         [%d candidates remaining]\n", solver->possible_count);
+        }
 
         if (all_correct) {
             printf("\n====================================\n");
@@ -173,6 +251,11 @@ int main(int argc, char* argv[]) {
             won = 1;
             break;
         }
+
+        /* Cache miss: compute the next hint now */
+        if (assistant_mode && !restored) {
+            hint = get_best_guess(solver);
+        }
         printf("\n");
     }
 
@@ -185,6 +268,9 @@ int main(int argc, char* argv[]) {
     }
 
     /* Free allocated memory */
+    if (speculator) {
+        free_speculator(speculator);
+    }
     if (solver) {
         free_solver(solver);
     }
@@ -13,6 +13,27 @@
 #include <string.h>
 #include "solver.h"
 
+/**
+ * @brief Adds a word's letters to the frequency tables
+ * 
+ * Repeated letters count once in letter_freq (e.g. 'E' in "EERIE")
+ * but once per position in position_freq.
+ */
+static void add_frequencies(SolverState* state, const char* word) {
+    bool seen[26] = {false};
+
+    for (int k = 0; k < WORD_LENGTH; k++) {
+        int letter_idx = word[k] - 'A';
+        if (letter_idx >= 0 && letter_idx < 26) {
+            state->position_freq[k][letter_idx]++;
+            if (!seen[letter_idx]) {
+                state->letter_freq[letter_idx]++;
+                seen[letter_idx] = true;
+            }
+        }
+    }
+}
+
 /**
  * @brief Initializes solver with all words as candidates
  */
@@ -25,6 +46,9 @@ SolverState* init_solver(char** all_words, int total_count) {
     state->all_words = all_words;
     state->total_words = total_count;
     state->possible_count = total_count;
+    state->strategy = STRATEGY_LETTER_FREQUENCY;
+    memset(state->letter_freq, 0, sizeof(state->letter_freq));
+    memset(state->position_freq, 0, sizeof(state->position_freq));
     
     /* Allocate boolean mask array */
     state->possible_mask = (bool*)malloc(total_count * sizeof(bool));
@@ -36,6 +60,7 @@ SolverState* init_solver(char** all_words, int total_count) {
     /* Initialize: all words are possible candidates */
     for (int i = 0; i < total_count; i++) {
         state->possible_mask[i] = true;
+        add_frequencies(state, all_words[i]);
     }
 
     return state;
@@ -53,6 +78,44 @@ void free_solver(SolverState* state) {
     }
 }
 
+/**
+ * @brief Copies solver state with its own candidate mask
+ * 
+ * Frequency tables and strategy are copied along with the struct.
+ */
+SolverState* clone_solver(const SolverState* state) {
+    SolverState* copy = (SolverState*)malloc(sizeof(SolverState));
+    if (!copy) {
+        return NULL;
+    }
+
+    *copy = *state;
+    copy->possible_mask = (bool*)malloc(state->total_words * sizeof(bool));
+    if (!copy->possible_mask) {
+        free(copy);
+        return NULL;
+    }
+    memcpy(copy->possible_mask, state->possible_mask,
+           state->total_words * sizeof(bool));
+
+    return copy;
+}
+
+/**
+ * @brief Clears the mask and tables, then marks only the given words
+ */
+void set_candidates(SolverState* state, const int* indices, int count) {
+    memset(state->possible_mask, 0, state->total_words * sizeof(bool));
+    memset(state->letter_freq, 0, sizeof(state->letter_freq));
+    memset(state->position_freq, 0, sizeof(state->position_freq));
+
+    for (int i = 0; i < count; i++) {
+        state->possible_mask[indices[i]] = true;
+        add_frequencies(state, state->all_words[indices[i]]);
+    }
+    state->possible_count = count;
+}
+
 /**
  * @brief Checks if a candidate could produce the observed feedback
  * 
@@ -78,15 +141,22 @@ static bool is_consistent(const char* candidate_answer,
  * Algorithm:
  * For each remaining candidate, check if it could have been the
  * target word given the feedback we received. If not, eliminate it.
+ * 
+ * The frequency tables are rebuilt from the kept words in the same
+ * pass. Most words are eliminated by each guess, so adding up the
+ * survivors is cheaper than subtracting the eliminated words.
  */
 void filter_candidates(SolverState* state, const char* guess, const char* result) {
     int new_count = 0;
+    memset(state->letter_freq, 0, sizeof(state->letter_freq));
+    memset(state->position_freq, 0, sizeof(state->position_freq));
     
     for (int i = 0; i < state->total_words; i++) {
         if (state->possible_mask[i]) {
             /* Keep word only if it's consistent with the feedback */
             if (is_consistent(state->all_words[i], guess, result)) {
                 new_count++;
+                add_frequencies(state, state->all_words[i]);
             } else {
                 state->possible_mask[i] = false;
             }
@@ -94,20 +164,22 @@ void filter_candidates(SolverState* state, const char* guess, const char* result
     }
     
     state->possible_count = new_count;
-    printf("         [%d candidates remaining]\n", new_count);
 }
 
 /**
  * @brief Selects the best guess using letter frequency scoring
  * 
  * Heuristic Strategy:
- * 1. Calculate how often each letter (A-Z) appears in remaining candidates
+ * 1. Read how often each letter (A-Z) appears in remaining candidates
+ *    from state->letter_freq (rebuilt from the survivors by filter_candidates)
  * 2. For each candidate, compute a score = sum of frequencies of its unique letters
+ *    (positional strategy: plus position_freq of each letter at its position)
  * 3. Select the word with the highest score
  * 
  * Rationale:
  * Words with common letters are more likely to produce useful feedback
- * (Green or Yellow), which helps eliminate more candidates.
+ * (Green or Yellow), which helps eliminate more candidates. Letters in
+ * their most common positions are more likely to come back Green.
  */
 char* get_best_guess(SolverState* state) {
     /* Handle edge cases */
@@ -124,30 +196,10 @@ char* get_best_guess(SolverState* state) {
         }
     }
 
-    /*
-     * Step 1: Calculate letter frequencies across remaining candidates
-     * We count unique letters per word to avoid over-counting
-     * repeated letters (e.g., 'E' in "EERIE")
-     */
-    int freq[26] = {0};
-    
-    for (int i = 0; i < state->total_words; i++) {
-        if (state->possible_mask[i]) {
-            const char* word = state->all_words[i];
-            bool seen[26] = {false};
-            
-            for (int k = 0; k < WORD_LENGTH; k++) {
-                int letter_idx = word[k] - 'A';
-                if (letter_idx >= 0 && letter_idx < 26 && !seen[letter_idx]) {
-                    freq[letter_idx]++;
-                    seen[letter_idx] = true;
-                }
-            }
-        }
-    }
+    bool positional = (state->strategy == STRATEGY_POSITIONAL_FREQUENCY);
 
     /*
-     * Step 2: Score each candidate and find the best
+     * Score each candidate and find the best
      * Score = sum of frequencies of unique letters in the word
      */
     char* best_word = NULL;
@@ -161,10 +213,16 @@ char* get_best_guess(SolverState* state) {
             
             for (int k = 0; k < WORD_LENGTH; k++) {
                 int letter_idx = word[k] - 'A';
-                if (letter_idx >= 0 && letter_idx < 26 && !seen[letter_idx]) {
-                    score += freq[letter_idx];
+                if (letter_idx < 0 || letter_idx >= 26) {
+                    continue;
+                }
+                if (!seen[letter_idx]) {
+                    score += state->letter_freq[letter_idx];
                     seen[letter_idx] = true;
                 }
+                if (positional) {
+                    score += state->position_freq[k][letter_idx];
+                }
             }
 
             if (score > max_score) {
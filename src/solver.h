@@ -18,6 +18,14 @@
  * DATA STRUCTURES
  *============================================================*/
 
+/**
+ * @brief Guess scoring strategy
+ */
+typedef enum {
+    STRATEGY_LETTER_FREQUENCY,      /**< Sum of unique letter frequencies (default) */
+    STRATEGY_POSITIONAL_FREQUENCY   /**< Letter frequencies plus per-position frequencies */
+} SolverStrategy;
+
 /**
  * @brief Solver state structure
  * 
@@ -25,6 +33,10 @@
  * Uses a boolean mask array for efficient candidate tracking
  * without copying/moving word pointers.
  * 
+ * The frequency tables always describe the current candidates:
+ * init_solver() builds them from all words and filter_candidates()
+ * rebuilds them from the survivors during its filtering pass.
+ * 
  * Space Complexity: O(n) where n = total words
  */
 typedef struct {
@@ -32,6 +44,9 @@ typedef struct {
     int total_words;        /**< Total count of words in master list */
     bool* possible_mask;    /**< Boolean array: true if word is still possible */
     int possible_count;     /**< Number of remaining candidates */
+    int letter_freq[26];    /**< Candidates containing each letter (counted once per word) */
+    int position_freq[WORD_LENGTH][26]; /**< Candidates with each letter at each position */
+    SolverStrategy strategy; /**< Scoring used by get_best_guess() */
 } SolverState;
 
 /*============================================================
@@ -41,8 +56,9 @@ typedef struct {
 /**
  * @brief Initializes the solver state
  * 
- * Allocates and initializes the solver with all words as candidates.
- * Time Complexity: O(n)
+ * Allocates and initializes the solver with all words as candidates,
+ * using STRATEGY_LETTER_FREQUENCY.
+ * Time Complexity: O(n * WORD_LENGTH)
  * Space Complexity: O(n) for the boolean mask
  * 
  * @param all_words Pointer to the master word list
@@ -58,6 +74,34 @@ SolverState* init_solver(char** all_words, int total_count);
  */
 void free_solver(SolverState* state);
 
+/**
+ * @brief Creates an independent copy of a solver state
+ * 
+ * The copy shares the master word list but owns its own mask,
+ * so it can be filtered without affecting the original.
+ * Time Complexity: O(n)
+ * 
+ * @param state Pointer to SolverState to copy
+ * @return Pointer to new SolverState, or NULL on failure
+ */
+SolverState* clone_solver(const SolverState* state);
+
+/**
+ * @brief Replaces the candidate set with a known list of survivors
+ * 
+ * Used to restore a previously computed filter result instead of
+ * re-running filter_candidates(). Frequency tables are rebuilt
+ * from the survivors.
+ * 
+ * Time Complexity: O(n + count * WORD_LENGTH), the O(n) part being
+ * a memset of the mask
+ * 
+ * @param state Pointer to SolverState
+ * @param indices Indices into all_words of the remaining candidates
+ * @param count Number of indices
+ */
+void set_candidates(SolverState* state, const int* indices, int count);
+
 /**
  * @brief Filters candidate words based on feedback
  * 
@@ -65,6 +109,9 @@ void free_solver(SolverState* state);
  * Uses consistency checking: for each candidate, simulate what
  * feedback it would give and compare to actual feedback.
  * 
+ * The frequency tables are rebuilt from the kept words in the same pass.
+ * Does not print anything; callers report possible_count themselves.
+ * 
  * Time Complexity: O(n * WORD_LENGTH^2) where n = remaining candidates
  * 
  * @param state Pointer to SolverState
@@ -77,14 +124,19 @@ void filter_candidates(SolverState* state, const char* guess, const char* result
  * @brief Determines the best next guess
  * 
  * Strategy: Letter Frequency Scoring
- * 1. Count frequency of each letter across all remaining candidates
+ * 1. Read letter frequencies from the tables rebuilt by
+ *    filter_candidates() from the survivors
  * 2. Score each candidate by sum of its unique letter frequencies
+ *    (STRATEGY_POSITIONAL_FREQUENCY also adds, for each position,
+ *    how many candidates have the same letter there)
  * 3. Choose the word with highest score
  * 
  * This heuristic maximizes information gain by preferring words
- * with commonly occurring letters.
+ * with commonly occurring letters; the positional term further
+ * prefers letters likely to come back Green.
  * 
- * Time Complexity: O(n * WORD_LENGTH) where n = remaining candidates
+ * Time Complexity: O(n * WORD_LENGTH) where n = remaining candidates,
+ * a single scoring pass
  * 
  * @param state Pointer to SolverState
  * @return Best guess word, or NULL if no candidates remain
@@ -0,0 +1,220 @@
+/**
+ * @file speculate.c
+ * @brief Implementation of speculative guess precomputation
+ *
+ * Uses a single POSIX thread to hide the solver's filtering and
+ * scoring time behind the time the player spends typing a guess.
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "speculate.h"
+
+/** Number of distinct feedback strings: 3^WORD_LENGTH */
+#define PATTERN_COUNT 243
+
+/**
+ * @brief Encodes a feedback string as a base-3 number
+ *
+ * X = 0, Y = 1, G = 2, first letter is the most significant digit.
+ */
+static int encode_pattern(const char* feedback) {
+    int code = 0;
+    for (int i = 0; i < WORD_LENGTH; i++) {
+        int digit = 0;
+        if (feedback[i] == RESULT_CORRECT) {
+            digit = 2;
+        } else if (feedback[i] == RESULT_PRESENT) {
+            digit = 1;
+        }
+        code = code * 3 + digit;
+    }
+    return code;
+}
+
+/**
+ * @brief Decodes a base-3 number back into a feedback string
+ */
+static void decode_pattern(int code, char* feedback) {
+    for (int i = WORD_LENGTH - 1; i >= 0; i--) {
+        int digit = code % 3;
+        code /= 3;
+        if (digit == 2) {
+            feedback[i] = RESULT_CORRECT;
+        } else if (digit == 1) {
+            feedback[i] = RESULT_PRESENT;
+        } else {
+            feedback[i] = RESULT_ABSENT;
+        }
+    }
+    feedback[WORD_LENGTH] = '\0';
+}
+
+/**
+ * @brief Background worker: fills the entry table
+ *
+ * Algorithm:
+ * 1. Bucket remaining candidates by the feedback the hint would
+ *    produce against them; bucket size = likelihood of that outcome
+ * 2. Repeatedly take the largest unvisited bucket (skipping the
+ *    winning pattern, which needs no follow-up)
+ * 3. Filter a private copy of the state and keep it with its best guess
+ *
+ * The cancel flag is checked before each outcome, so stale work
+ * stops after at most one filter + scoring pass.
+ */
+static void* speculation_worker(void* arg) {
+    Speculator* spec = (Speculator*)arg;
+    SolverState* snapshot = spec->snapshot;
+    int counts[PATTERN_COUNT] = {0};
+    char feedback[WORD_LENGTH + 1];
+
+    /* Step 1: Count how many candidates fall into each outcome */
+    for (int i = 0; i < snapshot->total_words; i++) {
+        if (snapshot->possible_mask[i]) {
+            get_feedback(snapshot->all_words[i], spec->guess, feedback);
+            counts[encode_pattern(feedback)]++;
+        }
+    }
+    counts[PATTERN_COUNT - 1] = 0;  /* All green: game is already won */
+
+    /* Steps 2-3: Most likely outcomes first */
+    while (spec->entry_count < SPEC_MAX_OUTCOMES) {
+        if (atomic_load(&spec->cancel)) {
+            break;
+        }
+
+        int best_code = -1;
+        for (int code = 0; code < PATTERN_COUNT; code++) {
+            if (counts[code] > 0 && (best_code < 0 || counts[code] > counts[best_code])) {
+                best_code = code;
+            }
+        }
+        if (best_code < 0) {
+            break;  /* Every possible outcome is cached */
+        }
+        counts[best_code] = 0;
+
+        SolverState* branch = clone_solver(snapshot);
+        if (!branch) {
+            break;
+        }
+        decode_pattern(best_code, feedback);
+        filter_candidates(branch, spec->guess, feedback);
+
+        SpecEntry* entry = &spec->entries[spec->entry_count];
+        strcpy(entry->feedback, feedback);
+        entry->branch = branch;
+        entry->best_guess = get_best_guess(branch);
+
+        spec->entry_count++;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Frees the branch states of all entries
+ *
+ * Only called while no worker is running.
+ */
+static void clear_entries(Speculator* spec) {
+    for (int i = 0; i < spec->entry_count; i++) {
+        free_solver(spec->entries[i].branch);
+    }
+    spec->entry_count = 0;
+}
+
+/**
+ * @brief Allocates an idle speculator
+ */
+Speculator* init_speculator(void) {
+    Speculator* spec = (Speculator*)malloc(sizeof(Speculator));
+    if (!spec) {
+        return NULL;
+    }
+
+    atomic_init(&spec->cancel, false);
+    spec->running = false;
+    spec->snapshot = NULL;
+    spec->guess[0] = '\0';
+    spec->entry_count = 0;
+
+    return spec;
+}
+
+/**
+ * @brief Stops the worker, then frees entries, snapshot and speculator
+ */
+void free_speculator(Speculator* spec) {
+    if (spec) {
+        cancel_speculation(spec);
+        clear_entries(spec);
+        free_solver(spec->snapshot);
+        free(spec);
+    }
+}
+
+/**
+ * @brief Signals the worker to stop and joins it
+ */
+void cancel_speculation(Speculator* spec) {
+    if (spec->running) {
+        atomic_store(&spec->cancel, true);
+        pthread_join(spec->thread, NULL);
+        spec->running = false;
+    }
+}
+
+/**
+ * @brief Snapshots the solver and launches the worker thread
+ */
+bool start_speculation(Speculator* spec, const SolverState* state, const char* guess) {
+    cancel_speculation(spec);
+
+    free_solver(spec->snapshot);
+    spec->snapshot = clone_solver(state);
+    clear_entries(spec);
+    if (!spec->snapshot) {
+        spec->guess[0] = '\0';
+        return false;
+    }
+
+    strncpy(spec->guess, guess, WORD_LENGTH);
+    spec->guess[WORD_LENGTH] = '\0';
+    atomic_store(&spec->cancel, false);
+
+    if (pthread_create(&spec->thread, NULL, speculation_worker, spec) != 0) {
+        return false;
+    }
+    spec->running = true;
+    return true;
+}
+
+/**
+ * @brief Cancels stale work, looks up the observed outcome and
+ *        swaps the precomputed state in on a hit
+ *
+ * The caller's old mask moves into the entry and is freed with it.
+ */
+char* take_speculation(Speculator* spec, const char* guess, const char* result,
+                       SolverState* state) {
+    cancel_speculation(spec);
+
+    if (strcmp(spec->guess, guess) != 0) {
+        return NULL;  /* Player ignored the hint */
+    }
+
+    for (int i = 0; i < spec->entry_count; i++) {
+        SpecEntry* entry = &spec->entries[i];
+        if (strcmp(entry->feedback, result) == 0 && entry->best_guess) {
+            bool* old_mask = state->possible_mask;
+            *state = *entry->branch;
+            entry->branch->possible_mask = old_mask;
+            return entry->best_guess;
+        }
+    }
+    return NULL;
+}
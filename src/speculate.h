@@ -0,0 +1,122 @@
+/**
+ * @file speculate.h
+ * @brief Header file for speculative guess precomputation
+ *
+ * While the program waits for the player to type a guess, a
+ * background thread computes the solver's next suggestion for the
+ * most likely feedback outcomes of the current hint. When the real
+ * feedback arrives, the answer is served from this cache.
+ *
+ * Course: ALGO3 - Algorithms & Data Structures in C
+ */
+
+#ifndef SPECULATE_H
+#define SPECULATE_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "wordle.h"
+#include "solver.h"
+
+/*============================================================
+ * CONSTANTS
+ *============================================================*/
+
+/** Maximum number of feedback outcomes precomputed per hint */
+#define SPEC_MAX_OUTCOMES 8
+
+/*============================================================
+ * DATA STRUCTURES
+ *============================================================*/
+
+/**
+ * @brief One precomputed answer
+ *
+ * Stores the solver state after filtering for 'feedback' and the
+ * next guess for that state, so a hit skips both filtering and scoring.
+ */
+typedef struct {
+    char feedback[WORD_LENGTH + 1]; /**< Assumed feedback (G/Y/X string) */
+    SolverState* branch;            /**< State filtered for 'feedback' (owned) */
+    char* best_guess;               /**< Next guess for that outcome (not owned) */
+} SpecEntry;
+
+/**
+ * @brief Speculator state structure
+ *
+ * Owns a snapshot of the solver state so the main thread can keep
+ * filtering its own copy while the worker runs. Entries are only
+ * read after the worker has been joined, so no lock is needed.
+ */
+typedef struct {
+    pthread_t thread;               /**< Background worker */
+    atomic_bool cancel;             /**< Set to ask the worker to stop */
+    bool running;                   /**< True while a worker must be joined */
+    SolverState* snapshot;          /**< Private copy of solver state (owned) */
+    char guess[WORD_LENGTH + 1];    /**< Hint the outcomes refer to */
+    SpecEntry entries[SPEC_MAX_OUTCOMES]; /**< Precomputed answers */
+    int entry_count;                /**< Number of valid entries */
+} Speculator;
+
+/*============================================================
+ * FUNCTION PROTOTYPES
+ *============================================================*/
+
+/**
+ * @brief Creates an idle speculator
+ *
+ * @return Pointer to new Speculator, or NULL on failure
+ */
+Speculator* init_speculator(void);
+
+/**
+ * @brief Frees speculator memory, stopping any running worker
+ *
+ * @param spec Pointer to Speculator to free
+ */
+void free_speculator(Speculator* spec);
+
+/**
+ * @brief Starts precomputing answers for a hint in the background
+ *
+ * Any previous work is cancelled first. The solver state is copied,
+ * so the caller may modify it immediately after this returns.
+ *
+ * Time Complexity (worker): O(k * n * WORD_LENGTH^2)
+ * where k = SPEC_MAX_OUTCOMES and n = remaining candidates
+ *
+ * @param spec Pointer to Speculator
+ * @param state Current solver state
+ * @param guess The hint expected to be played next
+ * @return true if the worker was started, false otherwise
+ */
+bool start_speculation(Speculator* spec, const SolverState* state, const char* guess);
+
+/**
+ * @brief Stops the background worker and waits for it to exit
+ *
+ * Entries already computed are kept.
+ *
+ * @param spec Pointer to Speculator
+ */
+void cancel_speculation(Speculator* spec);
+
+/**
+ * @brief Serves an observed outcome from the cache
+ *
+ * Cancels the worker (the remaining outcomes are now stale) and
+ * searches the cache. On a hit, 'state' is replaced by the
+ * precomputed filtered state (an O(1) swap), so the caller must not
+ * run filter_candidates(); on a miss, 'state' is left untouched.
+ *
+ * @param spec Pointer to Speculator
+ * @param guess The word that was actually played
+ * @param result The feedback actually received
+ * @param state Solver state the hint was computed from
+ * @return Cached next guess, or NULL on a cache miss
+ */
+char* take_speculation(Speculator* spec, const char* guess, const char* result,
+                       SolverState* state);
+
+#endif /* SPECULATE_H */